@@ -131,4 +131,26 @@ void run_demo() {
     cout << multiply(F, I5);
     cout << "Determinant of F: " << F.det() << '\n';
     cout << "So it's not invertable." << '\n';
+
+    // demo 10 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    cout << "\nWe can raise square matrices to powers, too!" << "\n";
+    Mat<2, 2, long> Fib = {{1, 1}, {1, 0}};
+    cout << "let Fib = \n";
+    cout << Fib;
+    cout << "Fib^30 = \n";
+    cout << pow(Fib, 30) << '\n';
+
+    // demo 11 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    cout << "Let's step a Markov chain!" << "\n";
+    // each column sums to 1, so P takes a distribution to the next one
+    Mat<3, 3, double> P = {{0.8, 0.1, 0.2}, {0.1, 0.7, 0.3}, {0.1, 0.2, 0.5}};
+    cout << "let P = \n";
+    cout << P;
+    std::vector<double> x0{1, 0, 0};
+    cout << "starting distribution: " << x0 << '\n';
+    cout << "after 3 steps: " << step_n(P, x0, 3) << '\n';
+    // passing a tolerance stops early once the steady state is reached
+    cout << "steady state: " << step_n(P, x0, 100000, {1e-12}) << '\n';
+    cout << "P^100000 (stops squaring once it converges) = \n";
+    cout << pow(P, 100000, {1e-12});
 }
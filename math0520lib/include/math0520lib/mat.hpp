@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iomanip>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
@@ -337,6 +338,60 @@ class Mat {
     template <size_t A, size_t B, size_t C, size_t D, typename T1>
     friend Mat<A, D, T1> multiply(const Mat<A, B, T1>& m1,
                                   const Mat<C, D, T1>& m2);
+
+    /**
+     * friend functions for repeated application of a square matrix
+     */
+    template <size_t N, typename T1>
+    friend Mat<N, N, T1> pow(const Mat<N, N, T1>& mat, size_t k,
+                             std::optional<T1> tolerance);
+
+    template <size_t N, typename T1>
+    friend std::vector<T1> step_n(const Mat<N, N, T1>& mat,
+                                  const std::vector<T1>& x, size_t n,
+                                  std::optional<T1> tolerance);
+
+  private:
+    // absolute difference that is also safe for unsigned types
+    static T abs_diff(T a, T b) { return a > b ? a - b : b - a; }
+
+    /**
+     * write m1 * m2 into dest, reusing the storage dest already owns
+     * dest must not alias m1 or m2
+     */
+    static void multiply_into(Mat& dest, const Mat& m1, const Mat& m2) {
+        static_assert(H == W, "multiply_into requires a square matrix: "
+                              "Mat::multiply_into\n");
+        for (size_t i = 0; i < H; i++) {
+            auto& dest_row = dest.rows[i];
+            const auto& m1_row = m1.rows[i];
+            for (size_t j = 0; j < W; j++) {
+                dest_row[j] = 0;
+            }
+            // i-k-j ordering walks rows of m2 contiguously
+            for (size_t k = 0; k < W; k++) {
+                const T scalar = m1_row[k];
+                const auto& m2_row = m2.rows[k];
+                for (size_t j = 0; j < W; j++) {
+                    dest_row[j] += scalar * m2_row[j];
+                }
+            }
+        }
+    }
+
+    // largest elem-wise absolute difference between two matrices
+    static T max_abs_diff(const Mat& a, const Mat& b) {
+        T max = 0;
+        for (size_t i = 0; i < H; i++) {
+            for (size_t j = 0; j < W; j++) {
+                T diff = abs_diff(a.rows[i][j], b.rows[i][j]);
+                if (diff > max) {
+                    max = diff;
+                }
+            }
+        }
+        return max;
+    }
 };
 
 // overload allowing easy cout interop with the Mat class
@@ -370,5 +425,116 @@ Mat<A, D, T> multiply(const Mat<A, B, T>& m1, const Mat<C, D, T>& m2) {
     }
     return result;
 }
+
+/**
+ * raise a square matrix to the k-th power using exponentiation by squaring
+ *
+ * all working storage is allocated once up front and ping-ponged between, so
+ * no matrices are allocated inside the loop
+ *
+ * if a tolerance is given, squaring stops early once the running square stops
+ * changing by more than the tolerance (e.g. a regular Markov transition matrix
+ * reaching its steady state), since every further square would be the same
+ *
+ * pow(mat, 0) is the identity matrix
+ */
+template <size_t N, typename T>
+[[nodiscard]] Mat<N, N, T> pow(const Mat<N, N, T>& mat, size_t k,
+                               std::optional<T> tolerance) {
+    Mat<N, N, T> result;
+    for (size_t i = 0; i < N; i++) {
+        result.rows[i][i] = 1;
+    }
+    Mat<N, N, T> base = mat;
+    Mat<N, N, T> scratch;
+    bool result_is_identity = true;
+
+    while (k > 0) {
+        if (k & 1) {
+            if (result_is_identity) {
+                result.rows = base.rows;
+                result_is_identity = false;
+            } else {
+                Mat<N, N, T>::multiply_into(scratch, result, base);
+                result.rows.swap(scratch.rows);
+            }
+        }
+        k >>= 1;
+        if (k == 0) {
+            break;
+        }
+        Mat<N, N, T>::multiply_into(scratch, base, base);
+        if (tolerance &&
+            Mat<N, N, T>::max_abs_diff(scratch, base) <= *tolerance) {
+            // base is (approximately) idempotent, so every remaining power of
+            // it is base itself, and only one more multiply is needed
+            if (result_is_identity) {
+                result.rows.swap(scratch.rows);
+            } else {
+                Mat<N, N, T>::multiply_into(scratch, result, base);
+                result.rows.swap(scratch.rows);
+            }
+            break;
+        }
+        base.rows.swap(scratch.rows);
+    }
+    return result;
+}
+
+// raise a square matrix to the k-th power, without early exit
+template <size_t N, typename T>
+[[nodiscard]] Mat<N, N, T> pow(const Mat<N, N, T>& mat, size_t k) {
+    return pow(mat, k, std::optional<T>{});
+}
+
+/**
+ * apply a square matrix to a column vector n times, returning mat^n * x
+ *
+ * for Markov chains, mat should be column-stochastic and x the distribution
+ *
+ * the two working vectors are allocated once and ping-ponged between steps
+ *
+ * if a tolerance is given, stepping stops early once no entry changes by more
+ * than the tolerance in a single step (i.e. a steady state has been reached)
+ */
+template <size_t N, typename T>
+[[nodiscard]] std::vector<T> step_n(const Mat<N, N, T>& mat,
+                                    const std::vector<T>& x, size_t n,
+                                    std::optional<T> tolerance) {
+    if (x.size() != N) {
+        throw std::logic_error("length of vector does not match num cols of "
+                               "matrix: step_n\n");
+    }
+    std::vector<T> current = x;
+    std::vector<T> next(N);
+
+    for (size_t step = 0; step < n; step++) {
+        T max_diff = 0;
+        for (size_t i = 0; i < N; i++) {
+            const auto& row = mat.rows[i];
+            T accum = 0;
+            for (size_t j = 0; j < N; j++) {
+                accum += row[j] * current[j];
+            }
+            next[i] = accum;
+            T diff = Mat<N, N, T>::abs_diff(accum, current[i]);
+            if (diff > max_diff) {
+                max_diff = diff;
+            }
+        }
+        current.swap(next);
+        if (tolerance && max_diff <= *tolerance) {
+            break;
+        }
+    }
+    return current;
+}
+
+// apply a square matrix to a column vector n times, without early exit
+template <size_t N, typename T>
+[[nodiscard]] std::vector<T> step_n(const Mat<N, N, T>& mat,
+                                    const std::vector<T>& x, size_t n) {
+    return step_n(mat, x, n, std::optional<T>{});
+}
 } // namespace m52l
 #endif // !MATH0520LIB_MAT_HPP
@@ -6,6 +6,7 @@
 #ifndef MATH0520LIB_VEC_HPP
 #define MATH0520LIB_VEC_HPP
 
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <sstream>